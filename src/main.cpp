@@ -10,6 +10,7 @@
 #include <sstream>
 #include <algorithm>
 #include <iomanip>
+#include <cmath>
 using namespace std;
 
 void setText(sf::Text& text, float x, float y) {
@@ -43,6 +44,7 @@ struct Tile {
     bool isMine = false;
     bool isFlagged = false;
     bool isRevealed = false;
+    bool isShown = false; // lags behind isRevealed while a cascade is animating
     int adjacentMines = 0;
 
     Tile(float x, float y, TextureManager& texm)
@@ -56,11 +58,12 @@ struct Tile {
         mine_sprite.setPosition(position);
     }
 
-    int toggleFlag() {
-        if (isRevealed) {
+    // returns how much the flag count changed
+    int setFlag(bool value) {
+        if (isRevealed || isFlagged == value) {
             return 0;
         }
-        isFlagged = !isFlagged;
+        isFlagged = value;
         return isFlagged ? 1 : -1;
     }
 
@@ -69,10 +72,11 @@ struct Tile {
             return;
         }
         isRevealed = true;
+        isShown = true;
     }
 
     void draw(sf::RenderWindow& window, TextureManager& texm, bool isDebug) {
-        if (isRevealed) {
+        if (isShown) {
             if (isMine) {
                 sprite.setTexture(texm.get("mine"));
             } else if (adjacentMines > 0) {
@@ -86,7 +90,7 @@ struct Tile {
 
         window.draw(sprite);
 
-        if (!isRevealed && isFlagged) {
+        if (!isShown && isFlagged) {
             window.draw(flag_sprite);
         }
 
@@ -127,19 +131,97 @@ void calculateAdjacency(std::vector<Tile> &tiles, int columns, int rows) {
     }
 }
 
-void revealTile(std::vector<Tile>& tiles, int index, int columns, int rows) {
+// flood reveal as a wavefront, every tile it reveals is appended to revealOrder in order
+// the order vector doubles as the bfs queue so nothing extra gets allocated per click
+void revealTile(std::vector<Tile>& tiles, int index, int columns, int rows, std::vector<int>& revealOrder) {
     if (tiles[index].isRevealed || tiles[index].isFlagged) {
         return;
     }
 
+    size_t head = revealOrder.size();
     tiles[index].isRevealed = true;
+    revealOrder.push_back(index);
 
     if (tiles[index].adjacentMines > 0) {
         return;
     }
 
+    while (head < revealOrder.size()) {
+        int current = revealOrder[head++];
+        if (tiles[current].adjacentMines > 0) {
+            continue;
+        }
+
+        int currentX = current % columns;
+        int currentY = current / columns;
+
+        for (int dx = -1; dx <= 1; dx++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                if (dx == 0 && dy == 0) continue;
+
+                int neighborX = currentX + dx;
+                int neighborY = currentY + dy;
+
+                if (neighborX >= 0 && neighborX < columns && neighborY >= 0 && neighborY < rows) {
+                    int neighborIndex = neighborX + (neighborY * columns);
+                    Tile& neighbor = tiles[neighborIndex];
+                    if (!neighbor.isMine && !neighbor.isRevealed && !neighbor.isFlagged) {
+                        neighbor.isRevealed = true;
+                        revealOrder.push_back(neighborIndex);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// tiles waiting to be shown, the logical reveal already happened so win checks stay exact
+struct RevealStream {
+    std::vector<int> order;
+    size_t next = 0;
+
+    void advance(std::vector<Tile>& tiles, size_t budget) {
+        size_t end = std::min(order.size(), next + budget);
+        for (; next < end; next++) {
+            tiles[order[next]].isShown = true;
+        }
+        if (next == order.size()) {
+            clear();
+        }
+    }
+
+    void flush(std::vector<Tile>& tiles) {
+        advance(tiles, order.size());
+    }
+
+    void clear() {
+        order.clear();
+        next = 0;
+    }
+};
+
+// board index under a point, -1 when it's off the board (tiles are 32x32 from the top left)
+int tileIndexAt(sf::Vector2f pos, int columns, int rows) {
+    if (pos.x < 0 || pos.y < 0) {
+        return -1;
+    }
+    int x = static_cast<int>(pos.x) / 32;
+    int y = static_cast<int>(pos.y) / 32;
+    if (x >= columns || y >= rows) {
+        return -1;
+    }
+    return x + (y * columns);
+}
+
+// chording: a number with exactly that many flags around it reveals the rest of its neighbors
+void chordTile(std::vector<Tile>& tiles, int index, int columns, int rows, std::vector<int>& revealOrder) {
+    if (!tiles[index].isRevealed || tiles[index].adjacentMines <= 0) {
+        return;
+    }
+
     int currentX = index % columns;
     int currentY = index / columns;
+    int flaggedCount = 0;
 
     for (int dx = -1; dx <= 1; dx++) {
         for (int dy = -1; dy <= 1; dy++) {
@@ -149,23 +231,125 @@ void revealTile(std::vector<Tile>& tiles, int index, int columns, int rows) {
             int neighborY = currentY + dy;
 
             if (neighborX >= 0 && neighborX < columns && neighborY >= 0 && neighborY < rows) {
-                int neighborIndex = neighborX + (neighborY * columns);
-                if (!tiles[neighborIndex].isMine) {
-                    revealTile(tiles, neighborIndex, columns, rows);
+                if (tiles[neighborX + (neighborY * columns)].isFlagged) {
+                    flaggedCount++;
                 }
             }
         }
     }
+
+    if (flaggedCount != tiles[index].adjacentMines) {
+        return;
+    }
+
+    for (int dx = -1; dx <= 1; dx++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            if (dx == 0 && dy == 0) continue;
+
+            int neighborX = currentX + dx;
+            int neighborY = currentY + dy;
+
+            if (neighborX >= 0 && neighborX < columns && neighborY >= 0 && neighborY < rows) {
+                revealTile(tiles, neighborX + (neighborY * columns), columns, rows, revealOrder);
+            }
+        }
+    }
 }
 
-bool checkWin(const std::vector<Tile>& tiles, int mineCount) {
-    int revealedCount = 0;
-    for (const auto& tile : tiles) {
-        if (tile.isRevealed) {
+enum class ActionKind { Flag, Click, Chord };
+
+struct BoardAction {
+    ActionKind kind;
+    int index;
+    bool value = false; // flag value for ActionKind::Flag
+};
+
+// board actions queued up during one frame of events, applied in arrival order by applyBatch
+struct InputBatch {
+    std::vector<BoardAction> actions;
+
+    // flag state of a tile once the pending actions have run
+    bool pendingFlag(const std::vector<Tile>& tiles, int index) const {
+        for (auto it = actions.rbegin(); it != actions.rend(); ++it) {
+            if (it->kind == ActionKind::Flag && it->index == index) {
+                return it->value;
+            }
+        }
+        return tiles[index].isFlagged;
+    }
+
+    // queues a flag for every cell on the straight line between two tiles, so fast drags don't skip any
+    void addFlagLine(int from, int to, int columns, bool value) {
+        int fromX = from % columns;
+        int fromY = from / columns;
+        int deltaX = (to % columns) - fromX;
+        int deltaY = (to / columns) - fromY;
+        int steps = std::max(std::abs(deltaX), std::abs(deltaY));
+
+        for (int step = 1; step <= steps; step++) {
+            int x = fromX + static_cast<int>(std::lround(deltaX * step / static_cast<double>(steps)));
+            int y = fromY + static_cast<int>(std::lround(deltaY * step / static_cast<double>(steps)));
+            actions.push_back({ActionKind::Flag, x + (y * columns), value});
+        }
+    }
+
+    bool empty() const {
+        return actions.empty();
+    }
+
+    void clear() {
+        actions.clear();
+    }
+};
+
+enum class BatchResult { None, Lost, Won };
+
+// applies queued actions in order and stops at the first one that ends the game
+// revealedCount is the running number of safe tiles revealed, so winning needs no full board scan
+BatchResult applyBatch(std::vector<Tile>& tiles, InputBatch& batch, int columns, int rows, int mineCount, int& flagCount, int& revealedCount, RevealStream& revealStream) {
+    BatchResult result = BatchResult::None;
+    int safeTiles = static_cast<int>(tiles.size()) - mineCount;
+    std::vector<int>& revealOrder = revealStream.order;
+
+    for (const auto& action : batch.actions) {
+        // the target still looks hidden mid-animation, show everything so input matches what's drawn
+        if (tiles[action.index].isRevealed && !tiles[action.index].isShown) {
+            revealStream.flush(tiles);
+        }
+
+        if (action.kind == ActionKind::Flag) {
+            flagCount += tiles[action.index].setFlag(action.value);
+            continue;
+        }
+
+        size_t actionStart = revealOrder.size();
+
+        // a click on a revealed number chords, same as handling it on its own
+        if (action.kind == ActionKind::Click && !tiles[action.index].isRevealed) {
+            revealTile(tiles, action.index, columns, rows, revealOrder);
+        } else {
+            chordTile(tiles, action.index, columns, rows, revealOrder);
+        }
+
+        // only the tiles this action revealed need checking
+        for (size_t i = actionStart; i < revealOrder.size(); i++) {
+            if (tiles[revealOrder[i]].isMine) {
+                result = BatchResult::Lost;
+                break;
+            }
             revealedCount++;
         }
+
+        if (result == BatchResult::None && revealedCount == safeTiles) {
+            result = BatchResult::Won;
+        }
+        if (result != BatchResult::None) {
+            break;
+        }
     }
-    return revealedCount == (tiles.size() - mineCount);
+
+    batch.clear();
+    return result;
 }
 
 void setGameLost(std::vector<Tile>& tiles, sf::Sprite& faceSprite, TextureManager& texm) {
@@ -173,6 +357,7 @@ void setGameLost(std::vector<Tile>& tiles, sf::Sprite& faceSprite, TextureManage
     for (auto& tile : tiles) {
         if (tile.isMine) {
             tile.isRevealed = true;
+            tile.isShown = true;
         }
     }
 }
@@ -221,6 +406,7 @@ void setupBoard(std::vector<Tile>& tiles, int mineCount, int columns, int rows)
         tile.isMine = false;
         tile.isFlagged = false;
         tile.isRevealed = false;
+        tile.isShown = false;
     }
 
     std::mt19937 rng(std::random_device{}());
@@ -258,53 +444,83 @@ void updateCounter(int count, sf::Sprite counterDigits[3], sf::Texture& digitTex
     counterDigits[2].setTextureRect(rect);
 }
 
-void showLeaderboard(sf::Font& font, unsigned int parentWidth, unsigned int parentHeight, int highlightRank = -1) {
-    unsigned int lbWidth = parentWidth / 2;
-    unsigned int lbHeight = (parentHeight - 100) / 2 + 50;
+// screens that share the one window
+enum class Scene { Welcome, Game, Leaderboard };
 
-    sf::RenderWindow leaderWindow(sf::VideoMode({lbWidth, lbHeight}), "Leaderboard", sf::Style::Close);
+// leaderboard panel drawn over the board, text only gets rebuilt when the file or highlight changes
+struct LeaderboardOverlay {
+    sf::RectangleShape panel;
+    sf::Text title;
+    sf::Text content;
 
-    std::string leaderboardContent;
-    std::ifstream file("files/leaderboard.txt");
-    if (file.is_open()) {
-        std::string line;
-        int rank = 0; // 0-based index for comparison
+    LeaderboardOverlay(sf::Font& font, unsigned int parentWidth, unsigned int parentHeight)
+        : title(font, "LEADERBOARD", 20),
+          content(font, "", 18)
+    {
+        float lbWidth = parentWidth / 2.0f;
+        float lbHeight = (parentHeight - 100) / 2.0f + 50;
 
-        while (std::getline(file, line)) {
-            size_t commaPos = line.find(',');
-            std::string time = line.substr(0, commaPos);
-            std::string name = line.substr(commaPos + 1);
+        panel.setSize({lbWidth, lbHeight});
+        panel.setFillColor(sf::Color::Blue);
+        panel.setPosition({(parentWidth - lbWidth) / 2.0f, (parentHeight - lbHeight) / 2.0f});
 
-            if (rank == highlightRank) {
-                name += "*";
-            }
+        title.setStyle(sf::Text::Bold | sf::Text::Underlined);
+        content.setStyle(sf::Text::Bold);
+    }
 
-            leaderboardContent += std::to_string(rank + 1) + ".\t" + time + "\t" + name + "\n\n";
-            rank++;
-        }
-        file.close();
+    // call after the leaderboard file changes so the next refresh reloads it
+    void invalidate() {
+        isDirty = true;
     }
 
-    sf::Text title(font, "LEADERBOARD", 20);
-    title.setStyle(sf::Text::Bold | sf::Text::Underlined);
-    setText(title, lbWidth / 2.0f, (lbHeight / 2.0f) - 120);
+    void refresh(int highlightRank = -1) {
+        if (!isDirty && highlightRank == cachedRank) {
+            return;
+        }
+
+        std::string leaderboardContent;
+        std::ifstream file("files/leaderboard.txt");
+        if (file.is_open()) {
+            std::string line;
+            int rank = 0; // 0-based index for comparison
 
-    sf::Text content(font, leaderboardContent, 18);
-    content.setStyle(sf::Text::Bold);
-    setText(content, lbWidth / 2.0f, (lbHeight / 2.0f) + 20);
+            while (std::getline(file, line)) {
+                size_t commaPos = line.find(',');
+                std::string time = line.substr(0, commaPos);
+                std::string name = line.substr(commaPos + 1);
 
-    while (leaderWindow.isOpen()) {
-        while (const auto event = leaderWindow.pollEvent()) {
-            if (event->is<sf::Event::Closed>()) {
-                leaderWindow.close();
+                if (rank == highlightRank) {
+                    name += "*";
+                }
+
+                leaderboardContent += std::to_string(rank + 1) + ".\t" + time + "\t" + name + "\n\n";
+                rank++;
             }
+            file.close();
         }
-        leaderWindow.clear(sf::Color::Blue);
-        leaderWindow.draw(title);
-        leaderWindow.draw(content);
-        leaderWindow.display();
+
+        float centerX = panel.getPosition().x + panel.getSize().x / 2.0f;
+        float centerY = panel.getPosition().y + panel.getSize().y / 2.0f;
+
+        setText(title, centerX, centerY - 120);
+
+        content.setString(leaderboardContent);
+        setText(content, centerX, centerY + 20);
+
+        isDirty = false;
+        cachedRank = highlightRank;
     }
-}
+
+    void draw(sf::RenderWindow& window) {
+        window.draw(panel);
+        window.draw(title);
+        window.draw(content);
+    }
+
+private:
+    bool isDirty = true;
+    int cachedRank = -1;
+};
 
 int updateLeaderboard(int newTime, std::string name) {
     std::vector<std::pair<int, std::string>> scores;
@@ -373,7 +589,9 @@ int main() {
     unsigned int windowWidth = columns * 32;
     unsigned int windowHeight = (rows * 32) + 100;
 
-    sf::RenderWindow welcomeWindow(sf::VideoMode({windowWidth, windowHeight}), "SFML Window", sf::Style::Close);
+    // one window for every screen, the scene decides what gets handled and drawn
+    sf::RenderWindow window(sf::VideoMode({windowWidth, windowHeight}), "Minesweeper", sf::Style::Close);
+    window.setFramerateLimit(60); // Good practice
 
     sf::Font font;
     if (!font.openFromFile("files/font.ttf")) {
@@ -401,60 +619,6 @@ int main() {
     nameText.setFillColor(sf::Color::Yellow);
     nameText.setStyle(sf::Text::Bold);
 
-    bool openGameWindow = false;
-
-
-    while (welcomeWindow.isOpen())
-    {
-        while (const optional event = welcomeWindow.pollEvent())
-        {
-            if (event->is<sf::Event::Closed>())
-            {
-                openGameWindow = false;
-                welcomeWindow.close();
-            }
-
-            if (const auto* textEntered = event->getIf<sf::Event::TextEntered>())
-            {
-                char typedChar = static_cast<char>(textEntered->unicode);
-                if (std::isalpha(typedChar) && playerName.length() < 10)
-                {
-                    playerName += (playerName.empty() ? std::toupper(typedChar) : std::tolower(typedChar));
-                }
-            }
-
-            if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>())
-            {
-                if (keyPressed->code == sf::Keyboard::Key::Backspace && !playerName.empty())
-                {
-                    playerName.pop_back();
-                }
-
-                if (keyPressed->code == sf::Keyboard::Key::Enter && !playerName.empty())
-                {
-                    openGameWindow = true;
-                    welcomeWindow.close();
-                }
-            }
-        }
-
-        nameText.setString(playerName + "|");
-        setText(nameText, windowWidth / 2.0f, (windowHeight / 2.0f) - 45);
-
-        welcomeWindow.clear(sf::Color::Blue);
-        welcomeWindow.draw(text);
-        welcomeWindow.draw(enterNametext);
-        welcomeWindow.draw(nameText);
-        welcomeWindow.display();
-    }
-
-    if (!openGameWindow) {return 0;}
-
-    //game window
-
-    sf::RenderWindow gameWindow(sf::VideoMode({windowWidth, windowHeight}), "Minesweeper", sf::Style::Close);
-    gameWindow.setFramerateLimit(60); // Good practice
-
     //img textures
     TextureManager texm;
     texm.load("hidden", "files/images/tile_hidden.png");
@@ -535,16 +699,79 @@ int main() {
     bool isDebugMode = false;
     int flagCount = 0;
 
+    // cascades are shown over a few frames, scaled so even huge boards finish in about half a second
+    RevealStream revealStream;
+    const size_t REVEAL_CELLS_PER_FRAME = std::max<size_t>(64, tiles.size() / 30);
+
+    // clicks, chords and right-drag flagging get batched per frame
+    InputBatch batch;
+    bool dragFlagging = false;
+    bool dragFlagValue = false;
+    int lastDragTile = -1;
+    int revealedCount = 0;
+
     // adding the mines
     setupBoard(tiles, minecount, columns, rows);
     calculateAdjacency(tiles, columns, rows);
     updateCounter(minecount - flagCount, counterDigits, texm.get("digits"));
 
+    LeaderboardOverlay leaderboard(font, windowWidth, windowHeight);
+    Scene scene = Scene::Welcome;
+    bool resumeAfterLeaderboard = false;
+
+    // one win/loss check and counter update for everything queued so far
+    auto applyPendingBatch = [&]() {
+        if (batch.empty()) {
+            return;
+        }
+        if (gameOver) {
+            batch.clear();
+            return;
+        }
+
+        int previousFlagCount = flagCount;
+        BatchResult result = applyBatch(tiles, batch, columns, rows, minecount, flagCount, revealedCount, revealStream);
 
-    // game loop
-    while (gameWindow.isOpen())
+        if (flagCount != previousFlagCount) {
+            updateCounter(minecount - flagCount, counterDigits, texm.get("digits"));
+        }
+
+        if (result == BatchResult::None) {
+            return;
+        }
+
+        gameOver = true;
+        gamePaused = false;
+        dragFlagging = false;
+        pauseButton.setTexture(texm.get("pause"));
+        revealStream.flush(tiles);
+
+        if (result == BatchResult::Lost) {
+            setGameLost(tiles, happyFace, texm);
+        }
+
+        else if (result == BatchResult::Won) {
+            setGameWon(tiles, happyFace, texm, flagCount, minecount);
+            updateCounter(0, counterDigits, texm.get("digits"));
+
+            auto now = std::chrono::high_resolution_clock::now();
+            auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - startTime);
+            int totalSeconds = duration.count() - elapsedPausedTime;
+
+            int newRank = updateLeaderboard(totalSeconds, playerName);
+
+            leaderboard.invalidate();
+            leaderboard.refresh(newRank);
+            resumeAfterLeaderboard = false;
+            scene = Scene::Leaderboard;
+        }
+    };
+
+
+    // main loop
+    while (window.isOpen())
     {
-        if (!gameOver && !gamePaused) {
+        if (scene == Scene::Game && !gameOver && !gamePaused) {
             auto now = std::chrono::high_resolution_clock::now();
             auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - startTime);
             long long totalSeconds = duration.count() - elapsedPausedTime;
@@ -560,21 +787,96 @@ int main() {
             }
         }
 
-        while (const optional event = gameWindow.pollEvent())
+        while (const optional event = window.pollEvent())
         {
-            if (event->is<sf::Event::Closed>()) gameWindow.close();
+            if (event->is<sf::Event::Closed>())
+            {
+                window.close();
+                break;
+            }
+
+            // welcome screen
+            if (scene == Scene::Welcome)
+            {
+                if (const auto* textEntered = event->getIf<sf::Event::TextEntered>())
+                {
+                    char typedChar = static_cast<char>(textEntered->unicode);
+                    if (std::isalpha(typedChar) && playerName.length() < 10)
+                    {
+                        playerName += (playerName.empty() ? std::toupper(typedChar) : std::tolower(typedChar));
+                    }
+                }
+
+                if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>())
+                {
+                    if (keyPressed->code == sf::Keyboard::Key::Backspace && !playerName.empty())
+                    {
+                        playerName.pop_back();
+                    }
+
+                    if (keyPressed->code == sf::Keyboard::Key::Enter && !playerName.empty())
+                    {
+                        scene = Scene::Game;
+                        startTime = std::chrono::high_resolution_clock::now();
+                    }
+                }
+                continue;
+            }
+
+            // leaderboard overlay, any click or escape closes it
+            if (scene == Scene::Leaderboard)
+            {
+                const auto* keyPressed = event->getIf<sf::Event::KeyPressed>();
+                bool closeOverlay = event->is<sf::Event::MouseButtonPressed>() ||
+                                    (keyPressed && keyPressed->code == sf::Keyboard::Key::Escape);
+
+                if (closeOverlay) {
+                    scene = Scene::Game;
+                    if (resumeAfterLeaderboard) {
+                        auto now = std::chrono::high_resolution_clock::now();
+                        elapsedPausedTime += std::chrono::duration_cast<std::chrono::seconds>(now - pauseTime).count();
+                        gamePaused = false;
+                        pauseButton.setTexture(texm.get("pause"));
+                    }
+                }
+                continue;
+            }
+
+            if (event->is<sf::Event::FocusLost>()) {
+                dragFlagging = false;
+            }
+
+            if (const auto* released = event->getIf<sf::Event::MouseButtonReleased>()) {
+                if (released->button == sf::Mouse::Button::Right) {
+                    dragFlagging = false;
+                }
+            }
+
+            // right-drag keeps setting the same flag value on every tile it crosses
+            if (const auto* moved = event->getIf<sf::Event::MouseMoved>()) {
+                if (dragFlagging && !gameOver && !gamePaused) {
+                    int index = tileIndexAt(static_cast<sf::Vector2f>(moved->position), columns, rows);
+                    if (index != -1 && index != lastDragTile) {
+                        batch.addFlagLine(lastDragTile, index, columns, dragFlagValue);
+                        lastDragTile = index;
+                    }
+                }
+            }
 
             if (event->is<sf::Event::MouseButtonPressed>()) {
                 auto mouseButton = event->getIf<sf::Event::MouseButtonPressed>();
-                sf::Vector2i mousePos = sf::Mouse::getPosition(gameWindow);
-                auto mousePosF = static_cast<sf::Vector2f>(mousePos);
+                auto mousePosF = static_cast<sf::Vector2f>(mouseButton->position);
 
                 if (happyFace.getGlobalBounds().contains(mousePosF)) {
                     setupBoard(tiles, minecount, columns, rows);
                     calculateAdjacency(tiles, columns, rows);
+                    revealStream.clear();
+                    batch.clear();
+                    dragFlagging = false;
 
                     // reset stuff
                     flagCount = 0;
+                    revealedCount = 0;
                     gameOver = false;
                     gamePaused = false;
                     isDebugMode = false;
@@ -590,6 +892,11 @@ int main() {
                     continue;
                 }
 
+                // clicks queued earlier this frame happened before the pause, so they go first
+                if (pauseButton.getGlobalBounds().contains(mousePosF)) {
+                    applyPendingBatch();
+                }
+
                 if (!gameOver && pauseButton.getGlobalBounds().contains(mousePosF)) {
                     gamePaused = !gamePaused;
                     if (gamePaused) {
@@ -603,30 +910,20 @@ int main() {
                 }
 
                 if (leaderboardButton.getGlobalBounds().contains(mousePosF)) {
+                    applyPendingBatch();
+                    if (scene == Scene::Leaderboard) {
+                        continue; // the queued clicks won, the overlay is already up
+                    }
+
                     gamePaused = true;
                     pauseButton.setTexture(texm.get("play"));
                     pauseTime = std::chrono::high_resolution_clock::now();
 
-                    gameWindow.clear(sf::Color::White);
-                    sf::Sprite revealedSprite(texm.get("revealed"));
-                    for (const auto& tile : tiles) {
-                        revealedSprite.setPosition(tile.position);
-                        gameWindow.draw(revealedSprite);
-                    }
-                    gameWindow.draw(happyFace);
-                    gameWindow.draw(debugButton);
-                    gameWindow.draw(pauseButton);
-                    gameWindow.draw(leaderboardButton);
-                    for (int i=0; i<3; i++) gameWindow.draw(counterDigits[i]);
-                    for (int i=0; i<4; i++) gameWindow.draw(timerDigits[i]);
-                    gameWindow.display();
-
-                    showLeaderboard(font, windowWidth, windowHeight);
-
-                    auto now = std::chrono::high_resolution_clock::now();
-                    elapsedPausedTime += std::chrono::duration_cast<std::chrono::seconds>(now - pauseTime).count();
-                    gamePaused = false;
-                    pauseButton.setTexture(texm.get("pause"));
+                    leaderboard.refresh();
+                    dragFlagging = false;
+                    resumeAfterLeaderboard = true;
+                    scene = Scene::Leaderboard;
+                    continue;
                 }
 
 
@@ -637,81 +934,82 @@ int main() {
                         isDebugMode = !isDebugMode;
                     }
 
-                    // tiles clickings
-                    for (int i = 0; i < tiles.size(); i++) {
-                        if (tiles[i].sprite.getGlobalBounds().contains(mousePosF)) {
-
-                            // right click -> reveals
-                            if (mouseButton->button == sf::Mouse::Button::Right) {
-                                int flagChange = tiles[i].toggleFlag();
-                                flagCount += flagChange;
-                                updateCounter(minecount - flagCount, counterDigits, texm.get("digits"));
-                            }
-
-                            // left click -> reveals
-                            if (mouseButton->button == sf::Mouse::Button::Left) {
-                                if (!tiles[i].isFlagged) {
-                                    revealTile(tiles, i, columns, rows);
-
-                                    if (tiles[i].isMine) {
-                                        gameOver = true;
-                                        setGameLost(tiles, happyFace, texm);
-                                    }
-
-                                    else if (checkWin(tiles, minecount)) {
-                                        gameOver = true;
-                                        setGameWon(tiles, happyFace, texm, flagCount, minecount);
-                                        updateCounter(0, counterDigits, texm.get("digits"));
-
-                                        auto now = std::chrono::high_resolution_clock::now();
-                                        auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - startTime);
-                                        int totalSeconds = duration.count() - elapsedPausedTime;
-
-                                        int newRank = updateLeaderboard(totalSeconds, playerName);
-
-                                        gameWindow.clear(sf::Color::White);
-                                        for (auto& tile : tiles) { tile.draw(gameWindow, texm, isDebugMode); }
-                                        gameWindow.draw(happyFace);
-                                        gameWindow.draw(debugButton);
-                                        gameWindow.draw(pauseButton);
-                                        gameWindow.draw(leaderboardButton);
-                                        for (int i=0; i<3; i++) gameWindow.draw(counterDigits[i]);
-                                        for (int i=0; i<4; i++) gameWindow.draw(timerDigits[i]);
-                                        gameWindow.display();
-
-                                        showLeaderboard(font, windowWidth, windowHeight, newRank);
-                                    }
-                                }
-                            }
+                    // tiles clickings, queued into the batch
+                    int index = tileIndexAt(mousePosF, columns, rows);
+                    if (index != -1) {
+
+                        // same as in applyBatch, a tile waiting in the reveal animation gets shown before it's acted on
+                        if (tiles[index].isRevealed && !tiles[index].isShown) {
+                            revealStream.flush(tiles);
+                        }
+
+                        // right click -> flags, and starts a drag
+                        if (mouseButton->button == sf::Mouse::Button::Right && !tiles[index].isRevealed) {
+                            dragFlagging = true;
+                            dragFlagValue = !batch.pendingFlag(tiles, index);
+                            lastDragTile = index;
+                            batch.actions.push_back({ActionKind::Flag, index, dragFlagValue});
+                        }
+
+                        // left click -> reveals, or chords on a revealed number
+                        if (mouseButton->button == sf::Mouse::Button::Left) {
+                            batch.actions.push_back({ActionKind::Click, index});
+                        }
+
+                        // middle click -> chords
+                        if (mouseButton->button == sf::Mouse::Button::Middle) {
+                            batch.actions.push_back({ActionKind::Chord, index});
                         }
                     }
                 }
             }
         }
 
-        gameWindow.clear(sf::Color::White);
+        applyPendingBatch();
+
+        if (scene == Scene::Welcome) {
+            nameText.setString(playerName + "|");
+            setText(nameText, windowWidth / 2.0f, (windowHeight / 2.0f) - 45);
+
+            window.clear(sf::Color::Blue);
+            window.draw(text);
+            window.draw(enterNametext);
+            window.draw(nameText);
+            window.display();
+            continue;
+        }
+
+        if (!gamePaused) {
+            revealStream.advance(tiles, REVEAL_CELLS_PER_FRAME);
+        }
+
+        window.clear(sf::Color::White);
 
         if (gamePaused) {
 
             sf::Sprite revealedSprite(texm.get("revealed"));
             for (const auto& tile : tiles) {
                 revealedSprite.setPosition(tile.position);
-                gameWindow.draw(revealedSprite);
+                window.draw(revealedSprite);
             }
         } else {
             // noraml tiles drawing
             for (auto& tile : tiles) {
-                tile.draw(gameWindow, texm, isDebugMode);
+                tile.draw(window, texm, isDebugMode);
             }
         }
 
-        gameWindow.draw(happyFace);
-        gameWindow.draw(debugButton);
-        gameWindow.draw(pauseButton);
-        gameWindow.draw(leaderboardButton);
-        for (int i = 0; i < 3; i++) gameWindow.draw(counterDigits[i]);
-        for (int i = 0; i < 4; i++) gameWindow.draw(timerDigits[i]);
+        window.draw(happyFace);
+        window.draw(debugButton);
+        window.draw(pauseButton);
+        window.draw(leaderboardButton);
+        for (int i = 0; i < 3; i++) window.draw(counterDigits[i]);
+        for (int i = 0; i < 4; i++) window.draw(timerDigits[i]);
+
+        if (scene == Scene::Leaderboard) {
+            leaderboard.draw(window);
+        }
 
-        gameWindow.display();
+        window.display();
     }
 }
\ No newline at end of file